@@ -15,12 +15,15 @@ using namespace concurrency::streams;
 KeyIDClient::KeyIDClient(KeyIDSettings settings)
 {
 	this->settings = settings;
-	this->service = make_shared<KeyIDService>(settings.url, settings.license, settings.timeout);
+	CreateService();
+
+	if (settings.warmupConnections > 0)
+		WarmUp();
 }
 
 KeyIDClient::KeyIDClient()
 {
-	this->service = make_shared<KeyIDService>(settings.url, settings.license, settings.timeout);
+	CreateService();
 }
 
 /// <summary>
@@ -38,6 +41,42 @@ const KeyIDSettings& KeyIDClient::GetSettings()
 void KeyIDClient::SetSettings(KeyIDSettings settings)
 {
 	this->settings = settings;
+	CreateService();
+
+	if (settings.warmupConnections > 0)
+		WarmUp();
+}
+
+/// <summary>
+/// Returns a snapshot of the client connection statistics.
+/// </summary>
+/// <returns>Connection statistics.</returns>
+KeyIDStats KeyIDClient::GetStats()
+{
+	lock_guard<mutex> lock(*statsLock);
+	return *stats;
+}
+
+/// <summary>
+/// Pre-establishes settings.warmupConnections keep-alive connections to KeyID services.
+/// </summary>
+/// <returns>Number of connections established (task)</returns>
+pplx::task<int> KeyIDClient::WarmUp()
+{
+	auto stats = this->stats;
+	auto statsLock = this->statsLock;
+	auto start = chrono::steady_clock::now();
+
+	warmup = service->WarmUp(settings.warmupConnections)
+	.then([=](int established)
+	{
+		lock_guard<mutex> lock(*statsLock);
+		stats->warmupConnections = established;
+		stats->warmupMs = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+		return established;
+	});
+
+	return warmup;
 }
 
 /// <summary>
@@ -132,6 +171,7 @@ pplx::task<web::json::value> KeyIDClient::EvaluateProfile(std::wstring entityID,
 	.then([=](http_response response)
 	{
 		json::value data = ParseResponse(response);
+		RecordEvaluation();
 
 		if (data[L"Error"].as_string() == L"Invalid license key.")
 			throw exception("Invalid license key.");
@@ -221,6 +261,29 @@ pplx::task<web::json::value> KeyIDClient::GetProfileInfo(std::wstring entityID)
 	});
 }
 
+/// <summary>
+/// Creates the REST service from the current settings and resets connection statistics.
+/// </summary>
+void KeyIDClient::CreateService()
+{
+	stats = make_shared<KeyIDStats>();
+	statsLock = make_shared<mutex>();
+	created = chrono::steady_clock::now();
+	warmup = pplx::task_from_result(0);
+	service = make_shared<KeyIDService>(settings.url, settings.license, settings.timeout, settings.strictSSL);
+}
+
+/// <summary>
+/// Records the time from service creation to the first completed evaluation.
+/// </summary>
+void KeyIDClient::RecordEvaluation()
+{
+	lock_guard<mutex> lock(*statsLock);
+
+	if (stats->timeToFirstEvaluationMs < 0)
+		stats->timeToFirstEvaluationMs = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - created).count();
+}
+
 /// <summary>
 /// Compares a given confidence and fidelity against pre-determined thresholds.
 /// </summary>
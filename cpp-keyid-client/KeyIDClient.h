@@ -2,9 +2,21 @@
 #include "KeyIDService.h"
 #include "KeyIDSettings.h"
 #include <string>
+#include <mutex>
+#include <chrono>
 #include <cpprest/http_client.h>
 #include <cpprest/json.h>
 
+/// <summary>
+/// KeyID client connection statistics. Durations are -1 until measured.
+/// </summary>
+struct KeyIDStats
+{
+	int warmupConnections = 0;
+	long long warmupMs = -1;
+	long long timeToFirstEvaluationMs = -1;
+};
+
 /// <summary>
 /// KeyID client.
 /// </summary>
@@ -16,6 +28,8 @@ public:
 	~KeyIDClient();
 	const KeyIDSettings& GetSettings();
 	void SetSettings(KeyIDSettings settings);
+	KeyIDStats GetStats();
+	pplx::task<int> WarmUp();
 
 	pplx::task<web::json::value> SaveProfile(std::wstring entityID, std::wstring tsData, std::wstring sessionID = L"");
 	pplx::task<web::json::value> RemoveProfile(std::wstring entityID, std::wstring tsData = L"", std::wstring sessionID = L"");
@@ -26,6 +40,13 @@ public:
 private:
 	std::shared_ptr<KeyIDService> service;
 	KeyIDSettings settings;
+	std::shared_ptr<KeyIDStats> stats;
+	std::shared_ptr<std::mutex> statsLock;
+	std::chrono::steady_clock::time_point created;
+	pplx::task<int> warmup;
+
+	void CreateService();
+	void RecordEvaluation();
 
 	bool EvalThreshold(double confidence, double fidelity);
 	bool AlphaToBool(std::wstring input);
@@ -1,5 +1,6 @@
 #include "KeyIDService.h"
 #include <cpprest/filestream.h>
+#include <vector>
 
 using namespace std;
 using namespace web;
@@ -13,11 +14,21 @@ using namespace concurrency::streams;
 /// <param name="url">KeyID services URL.</param>
 /// <param name="license">KeyID services license key.</param>
 /// <param name="timeoutMs">REST web service timeout.</param>
-KeyIDService::KeyIDService(std::wstring url, std::wstring license, int timeoutMs)
+/// <param name="strictSSL">Whether to validate the server certificate.</param>
+KeyIDService::KeyIDService(std::wstring url, std::wstring license, int timeoutMs, bool strictSSL)
 {
 	this->url = url;
 	this->license = license;
-	client = new http_client(url);
+
+	// a single long lived client keeps its connections alive between requests,
+	// which also lets the platform TLS session cache resume sessions on reconnect
+	http_client_config config;
+	config.set_validate_certificates(strictSSL);
+
+	if (timeoutMs > 0)
+		config.set_timeout(std::chrono::milliseconds(timeoutMs));
+
+	client = new http_client(url, config);
 }
 
 /// <summary>
@@ -28,6 +39,47 @@ KeyIDService::~KeyIDService()
 	delete client;
 }
 
+/// <summary>
+/// Pre-establishes keep-alive connections to KeyID REST services.
+/// </summary>
+/// <param name="connections">Number of concurrent connections to open.</param>
+/// <returns>Number of connections that completed a request.</returns>
+pplx::task<int> KeyIDService::WarmUp(int connections)
+{
+	if (connections <= 0)
+		return pplx::task_from_result(0);
+
+	vector<pplx::task<int>> requests;
+
+	// concurrent requests force the client to open a separate connection for each
+	for (int i = 0; i < connections; i++)
+	{
+		requests.push_back(client->request(methods::HEAD, L"/")
+		.then([](pplx::task<http_response> previous)
+		{
+			// any response, even an error status, means the connection is up
+			try
+			{
+				previous.get();
+				return 1;
+			}
+			catch (const exception&)
+			{
+				return 0;
+			}
+		}));
+	}
+
+	return pplx::when_all(requests.begin(), requests.end())
+	.then([](vector<int> results)
+	{
+		int established = 0;
+		for (int result : results)
+			established += result;
+		return established;
+	});
+}
+
 /// <summary>
 /// URL encodes the properties of a JSON object
 /// </summary>
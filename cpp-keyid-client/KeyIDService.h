@@ -10,8 +10,9 @@
 class KeyIDService
 {
 public:
-	KeyIDService(std::wstring url, std::wstring license, int timeoutMs = 1000);
+	KeyIDService(std::wstring url, std::wstring license, int timeoutMs = 1000, bool strictSSL = true);
 	~KeyIDService();
+	pplx::task<int> WarmUp(int connections);
 	pplx::task<web::http::http_response> TypingMistake(std::wstring entityID, std::wstring mistype = L"", std::wstring sessionID = L"", std::wstring source = L"", std::wstring action = L"", std::wstring tmplate = L"", std::wstring page = L"");
 	pplx::task<web::http::http_response> EvaluateSample(std::wstring entityID, std::wstring tsData, std::wstring nonce);
 	pplx::task<web::http::http_response> Nonce(long long nonceTime);
@@ -12,4 +12,5 @@ struct KeyIDSettings
 	double thresholdFidelity = 50.0;
 	int timeout = 0;
 	bool strictSSL = true;
+	int warmupConnections = 0;
 };
\ No newline at end of file